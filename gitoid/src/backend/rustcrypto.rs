@@ -11,6 +11,12 @@ use digest::OutputSizeUser;
 
 #[cfg(feature = "sha1")]
 /// SHA-1 algorithm,
+///
+/// The underlying `sha1` crate detects CPU support for the SHA
+/// extensions at runtime on `x86` and `x86_64`, so the compression
+/// function dispatches to the SHA-NI instructions (`sha1rnds4`,
+/// `sha1nexte`, `sha1msg1`, `sha1msg2`) where available, falling back
+/// to the portable software implementation elsewhere.
 pub struct Sha1 {
     #[doc(hidden)]
     _private: (),
@@ -31,6 +37,11 @@ impl_hash_algorithm!(Sha1Cd, sha1collisiondetection::Sha1CD, "sha1cd");
 
 #[cfg(feature = "sha256")]
 /// SHA-256 algorithm.
+///
+/// As with [`Sha1`], the compression function is hardware-accelerated
+/// where possible: the `sha2` crate checks for the SHA extensions at
+/// runtime on `x86` and `x86_64` and uses the `sha256rnds2`,
+/// `sha256msg1`, and `sha256msg2` instructions when present.
 pub struct Sha256 {
     #[doc(hidden)]
     _private: (),
@@ -13,6 +13,7 @@ use core::fmt::Result as FmtResult;
 use core::hash::Hash;
 use core::hash::Hasher;
 use core::marker::PhantomData;
+#[cfg(feature = "url")]
 use core::ops::Not as _;
 use core::result::Result as StdResult;
 use core::str::FromStr;
@@ -146,7 +147,7 @@ where
     #[cfg(feature = "hex")]
     /// Convert the hash to a hexadecimal string.
     pub fn as_hex(&self) -> String {
-        hex::encode(self.as_bytes())
+        crate::hex::encode(self.as_bytes())
     }
 
     /// Get the hash algorithm used for the `GitOid`.
@@ -163,6 +164,32 @@ where
     pub fn hash_len(&self) -> usize {
         <H::Alg as OutputSizeUser>::output_size()
     }
+
+    #[cfg(feature = "url")]
+    /// Parse a gitoid URL of exactly the expected shape.
+    ///
+    /// A valid gitoid URL for this type is fully known up to the hash:
+    /// `gitoid:<object type>:<hash algorithm>:<hex hash>`. Match that prefix
+    /// directly and decode the hash in place, skipping the general URL
+    /// parser and its allocation. Returns `None` for anything else, leaving
+    /// error reporting to the general parser.
+    fn from_str_fast(s: &str) -> Option<GitOid<H, O>> {
+        let hex_str = s
+            .strip_prefix(GITOID_URL_SCHEME)?
+            .strip_prefix(':')?
+            .strip_prefix(O::NAME)?
+            .strip_prefix(':')?
+            .strip_prefix(H::NAME)?
+            .strip_prefix(':')?;
+
+        let mut value = GenericArray::generate(|_| 0);
+        crate::hex::decode_to_slice(hex_str, &mut value).ok()?;
+
+        Some(GitOid {
+            _phantom: PhantomData,
+            value: H::array_from_generic(value),
+        })
+    }
 }
 
 impl<H, O> FromStr for GitOid<H, O>
@@ -173,6 +200,10 @@ where
     type Err = Error;
 
     fn from_str(s: &str) -> Result<GitOid<H, O>> {
+        if let Some(gitoid) = GitOid::from_str_fast(s) {
+            return Ok(gitoid);
+        }
+
         let url = Url::parse(s)?;
         GitOid::try_from_url(url)
     }
@@ -286,8 +317,7 @@ where
         S: Serializer,
     {
         // Serialize self as the URL string.
-        let self_as_url_str = self.url().to_string();
-        serializer.serialize_str(&self_as_url_str)
+        serializer.serialize_str(self.url().as_str())
     }
 }
 
@@ -342,7 +372,7 @@ where
     _object_type: PhantomData<O>,
 }
 
-#[allow(dead_code)]
+#[cfg(feature = "url")]
 fn some_if_not_empty(s: &str) -> Option<&str> {
     s.is_empty().not().then_some(s)
 }
@@ -419,7 +449,7 @@ where
         // TODO(alilleybrinker): When `sha1` et al. move to generic-array 1.0,
         //                       update this to use the `arr!` macro.
         let mut value = GenericArray::generate(|_| 0);
-        hex::decode_to_slice(hex_str, &mut value)?;
+        crate::hex::decode_to_slice(hex_str, &mut value)?;
 
         let expected_size = <H::Alg as OutputSizeUser>::output_size();
         if value.len() != expected_size {
@@ -458,10 +488,12 @@ where
     O: ObjectType,
     R: Read,
 {
-    let expected_hash_length = <H::Alg as OutputSizeUser>::output_size();
     let (hash, amount_read) =
         hash_from_buffer::<H::Alg, O, R>(digester, reader, expected_read_length)?;
 
+    // Only the amount read needs a runtime check; the hash length is
+    // guaranteed by the type, since the digester produces a
+    // `GenericArray` whose length is the algorithm's output size.
     if amount_read != expected_read_length {
         return Err(Error::UnexpectedReadLength {
             expected: expected_read_length,
@@ -469,13 +501,6 @@ where
         });
     }
 
-    if hash.len() != expected_hash_length {
-        return Err(Error::UnexpectedHashLength {
-            expected: expected_hash_length,
-            observed: hash.len(),
-        });
-    }
-
     Ok(GitOid {
         _phantom: PhantomData,
         value: H::array_from_generic(hash),
@@ -493,10 +518,12 @@ where
     H: HashAlgorithm,
     O: ObjectType,
 {
-    let expected_hash_length = <H::Alg as OutputSizeUser>::output_size();
     let (hash, amount_read) =
         hash_from_buffer::<H::Alg, O>(digester, reader, expected_read_length)?;
 
+    // Only the amount read needs a runtime check; the hash length is
+    // guaranteed by the type, since the digester produces a
+    // `GenericArray` whose length is the algorithm's output size.
     if amount_read != expected_read_length {
         return Err(Error::UnexpectedReadLength {
             expected: expected_read_length,
@@ -504,13 +531,6 @@ where
         });
     }
 
-    if hash.len() != expected_hash_length {
-        return Err(Error::UnexpectedHashLength {
-            expected: expected_hash_length,
-            observed: hash.len(),
-        });
-    }
-
     Ok(GitOid {
         _phantom: PhantomData,
         value: H::array_from_generic(hash),
@@ -613,10 +633,12 @@ where
     O: ObjectType,
     R: AsyncRead + Unpin,
 {
-    let expected_hash_length = <H::Alg as OutputSizeUser>::output_size();
     let (hash, amount_read) =
         hash_from_async_buffer::<H::Alg, O, R>(digester, reader, expected_read_length).await?;
 
+    // Only the amount read needs a runtime check; the hash length is
+    // guaranteed by the type, since the digester produces a
+    // `GenericArray` whose length is the algorithm's output size.
     if amount_read != expected_read_length {
         return Err(Error::UnexpectedHashLength {
             expected: expected_read_length,
@@ -624,13 +646,6 @@ where
         });
     }
 
-    if hash.len() != expected_hash_length {
-        return Err(Error::UnexpectedHashLength {
-            expected: expected_hash_length,
-            observed: hash.len(),
-        });
-    }
-
     Ok(GitOid {
         _phantom: PhantomData,
         value: H::array_from_generic(hash),
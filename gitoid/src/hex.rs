@@ -0,0 +1,233 @@
+//! Fast hexadecimal handling for `GitOid` hashes.
+//!
+//! Hex encoding happens whenever a [`GitOid`] is displayed, and decoding
+//! happens on the hot path when parsing gitoid-scheme URLs. Rather than
+//! converting one character at a time, both directions use a SWAR
+//! ("SIMD within a register") conversion which handles eight hex
+//! characters per step, with no per-character branching.
+
+#[cfg(doc)]
+use crate::GitOid;
+
+#[cfg(feature = "url")]
+use core::result::Result as StdResult;
+#[cfg(feature = "url")]
+use hex::FromHexError;
+
+/// How many hex characters are converted per SWAR step.
+const SWAR_CHUNK: usize = 8;
+
+#[cfg(feature = "url")]
+/// Nibble value for every possible byte, with `-1` marking non-hex bytes.
+///
+/// This is the classic table-driven decoder used as the portable fallback
+/// by mainstream hex libraries. Here it backs both the validation scan and
+/// the odd-tail decode beneath the SWAR and SSSE3 paths.
+const HEX_LUT: [i8; 256] = build_hex_lut();
+
+#[cfg(feature = "url")]
+/// Build [`HEX_LUT`] at compile time.
+const fn build_hex_lut() -> [i8; 256] {
+    let mut lut = [-1i8; 256];
+    let mut i = 0;
+
+    while i < lut.len() {
+        let c = i as u8;
+
+        lut[i] = match c {
+            b'0'..=b'9' => (c - b'0') as i8,
+            b'a'..=b'f' => (c - b'a' + 10) as i8,
+            b'A'..=b'F' => (c - b'A' + 10) as i8,
+            _ => -1,
+        };
+
+        i += 1;
+    }
+
+    lut
+}
+
+/// Encode bytes as a lowercase hexadecimal string.
+///
+/// This matches the output of `hex::encode`, but expands four bytes into
+/// eight hex characters per step with branch-free SWAR arithmetic rather
+/// than looking characters up one nibble at a time.
+pub(crate) fn encode<B: AsRef<[u8]>>(bytes: B) -> String {
+    let bytes = bytes.as_ref();
+    let mut out = Vec::with_capacity(bytes.len() * 2);
+
+    let chunks = bytes.chunks_exact(SWAR_CHUNK / 2);
+    let remainder = chunks.remainder();
+
+    for chunk in chunks {
+        // PANIC SAFETY: `chunks_exact` guarantees the chunk is four bytes.
+        let block = u32::from_le_bytes(chunk.try_into().unwrap());
+        out.extend_from_slice(&encode_swar(block));
+    }
+
+    // The hash lengths we care about are multiples of four bytes, but
+    // handle any tail for completeness.
+    for byte in remainder {
+        out.push(hex_digit_char(byte >> 4));
+        out.push(hex_digit_char(byte & 0xF));
+    }
+
+    // PANIC SAFETY: Every byte written above is an ASCII hex character.
+    String::from_utf8(out).unwrap()
+}
+
+/// Encode four bytes as eight hex characters in one SWAR step.
+#[inline]
+fn encode_swar(block: u32) -> [u8; 8] {
+    // Spread each input byte into every other lane of a `u64`.
+    let spread = block as u64;
+    let spread = (spread | (spread << 16)) & 0x0000_FFFF_0000_FFFF;
+    let spread = (spread | (spread << 8)) & 0x00FF_00FF_00FF_00FF;
+
+    // Split each byte into its two nibbles, high nibble first.
+    let nibbles = ((spread >> 4) & 0x000F_000F_000F_000F) | ((spread & 0x000F_000F_000F_000F) << 8);
+
+    // Map every nibble to ASCII in parallel: start from '0', then add the
+    // 'a' - '9' - 1 gap wherever the nibble is ten or above, detected by
+    // whether adding six carries into the high nibble.
+    let gap = ((nibbles + 0x0606_0606_0606_0606) >> 4) & 0x0101_0101_0101_0101;
+    let ascii = nibbles + 0x3030_3030_3030_3030 + gap * 0x27;
+
+    ascii.to_le_bytes()
+}
+
+/// Get the lowercase hex character for a nibble value.
+#[inline]
+fn hex_digit_char(value: u8) -> u8 {
+    value + 0x30 + (((value + 0x06) >> 4) & 0x01) * 0x27
+}
+
+#[cfg(feature = "url")]
+/// Decode a hex string into the provided buffer.
+///
+/// This is a drop-in replacement for `hex::decode_to_slice`, producing
+/// the same results and errors, including the index of the first invalid
+/// character when one is present.
+pub(crate) fn decode_to_slice(src: &str, dst: &mut [u8]) -> StdResult<(), FromHexError> {
+    let src = src.as_bytes();
+
+    if !src.len().is_multiple_of(2) {
+        return Err(FromHexError::OddLength);
+    }
+
+    if src.len() / 2 != dst.len() {
+        return Err(FromHexError::InvalidStringLength);
+    }
+
+    // Validate up front in a single scan so the conversion below can be
+    // branch-free.
+    if let Some(index) = src.iter().position(|&b| HEX_LUT[b as usize] < 0) {
+        return Err(FromHexError::InvalidHexCharacter {
+            c: src[index] as char,
+            index,
+        });
+    }
+
+    #[cfg(any(target_arch = "x86", target_arch = "x86_64"))]
+    if std::arch::is_x86_feature_detected!("ssse3") {
+        // SAFETY: SSSE3 is available, and the input has been validated.
+        unsafe { ssse3::decode_validated(src, dst) };
+        return Ok(());
+    }
+
+    decode_validated_swar(src, dst);
+
+    Ok(())
+}
+
+#[cfg(feature = "url")]
+/// Decode already-validated hex characters with the portable SWAR path.
+fn decode_validated_swar(src: &[u8], dst: &mut [u8]) {
+    let mut chunks = src.chunks_exact(SWAR_CHUNK);
+    let mut outputs = dst.chunks_exact_mut(SWAR_CHUNK / 2);
+
+    for (chunk, output) in (&mut chunks).zip(&mut outputs) {
+        // PANIC SAFETY: `chunks_exact` guarantees the chunk is eight bytes.
+        let block = u64::from_le_bytes(chunk.try_into().unwrap());
+        output.copy_from_slice(&decode_swar(block));
+    }
+
+    // The hash lengths we care about are multiples of eight characters,
+    // but handle any tail for completeness.
+    for (pair, output) in chunks
+        .remainder()
+        .chunks_exact(2)
+        .zip(outputs.into_remainder())
+    {
+        *output = ((HEX_LUT[pair[0] as usize] as u8) << 4) | HEX_LUT[pair[1] as usize] as u8;
+    }
+}
+
+#[cfg(feature = "url")]
+/// Decode eight hex characters to four bytes in one SWAR step.
+///
+/// The characters must already be validated as hex digits.
+#[inline]
+fn decode_swar(block: u64) -> [u8; 4] {
+    // Convert every character to its nibble value in parallel, using the
+    // identity `value = (c & 0xF) + 9 * bit6(c)`: for '0'..='9' bit 6 is
+    // clear and the low nibble is the value; for 'a'..='f' and 'A'..='F'
+    // bit 6 is set and the low nibble is off by nine.
+    let nibbles = (block & 0x0F0F_0F0F_0F0F_0F0F) + ((block >> 6) & 0x0101_0101_0101_0101) * 9;
+
+    // Merge adjacent nibbles, leaving each output byte in every other
+    // lane: lanes 0, 2, 4, and 6 of `paired` hold the four output bytes.
+    let paired = ((nibbles << 4) | (nibbles >> 8)) & 0x00FF_00FF_00FF_00FF;
+
+    // Compact the four populated lanes down to the low four bytes.
+    let gathered = paired | (paired >> 8);
+    let compact = (gathered & 0xFFFF) | ((gathered >> 16) & 0xFFFF_0000);
+
+    (compact as u32).to_le_bytes()
+}
+
+#[cfg(feature = "url")]
+#[cfg(any(target_arch = "x86", target_arch = "x86_64"))]
+mod ssse3 {
+    #[cfg(target_arch = "x86")]
+    use core::arch::x86::*;
+    #[cfg(target_arch = "x86_64")]
+    use core::arch::x86_64::*;
+
+    /// Decode already-validated hex characters, sixteen at a time.
+    ///
+    /// Sixteen-character blocks divide both the 40-character SHA-1 and
+    /// 64-character SHA-256 hash lengths reasonably well; any remainder
+    /// falls through to the SWAR path.
+    ///
+    /// # Safety
+    ///
+    /// SSSE3 must be available at runtime, `src` must hold only ASCII hex
+    /// digits, and `dst` must be exactly half the length of `src`.
+    #[target_feature(enable = "ssse3")]
+    pub(super) unsafe fn decode_validated(src: &[u8], dst: &mut [u8]) {
+        let mut chunks = src.chunks_exact(16);
+        let mut outputs = dst.chunks_exact_mut(8);
+
+        for (chunk, output) in (&mut chunks).zip(&mut outputs) {
+            let chars = _mm_loadu_si128(chunk.as_ptr() as *const __m128i);
+
+            // Letter adjustment looked up by each character's high nibble:
+            // '0'..='9' are in row 0x3 (adjust by zero), while 'A'..='F'
+            // and 'a'..='f' are in rows 0x4 and 0x6 (adjust by nine).
+            let adjust_lut = _mm_setr_epi8(0, 0, 0, 0, 9, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+            let rows = _mm_and_si128(_mm_srli_epi16(chars, 4), _mm_set1_epi8(0x0F));
+            let adjust = _mm_shuffle_epi8(adjust_lut, rows);
+            let nibbles = _mm_add_epi8(_mm_and_si128(chars, _mm_set1_epi8(0x0F)), adjust);
+
+            // Multiply-add adjacent nibble pairs into `high * 16 + low`
+            // in each 16-bit lane, then narrow the lanes back to bytes.
+            let combined = _mm_maddubs_epi16(nibbles, _mm_set1_epi16(0x0110));
+            let bytes = _mm_packus_epi16(combined, combined);
+
+            _mm_storel_epi64(output.as_mut_ptr() as *mut __m128i, bytes);
+        }
+
+        super::decode_validated_swar(chunks.remainder(), outputs.into_remainder());
+    }
+}
@@ -133,6 +133,8 @@ mod backend;
 mod error;
 mod gitoid;
 mod hash_algorithm;
+#[cfg(feature = "hex")]
+mod hex;
 mod object_type;
 pub(crate) mod sealed;
 #[cfg(test)]
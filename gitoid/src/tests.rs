@@ -7,6 +7,8 @@ use crate::rustcrypto::Sha1;
 use crate::rustcrypto::Sha256;
 #[cfg(feature = "std")]
 use std::fs::File;
+#[cfg(all(feature = "sha256", feature = "rustcrypto"))]
+use std::sync::OnceLock;
 #[cfg(feature = "async")]
 use tokio::fs::File as AsyncFile;
 #[cfg(feature = "async")]
@@ -20,6 +22,31 @@ use {
     serde_test::{assert_tokens, Token},
 };
 
+#[cfg(all(feature = "sha256", feature = "rustcrypto"))]
+/// Get the SHA-256 `GitOid` of `"hello world"`, hashed only once.
+///
+/// Several tests check independent properties of the same input, so
+/// share one memoized hash rather than recomputing it per test.
+fn hello_world_sha256() -> &'static GitOid<Sha256, Blob> {
+    static GITOID: OnceLock<GitOid<Sha256, Blob>> = OnceLock::new();
+    GITOID.get_or_init(|| GitOid::id_bytes(b"hello world"))
+}
+
+#[cfg(all(feature = "sha256", feature = "rustcrypto", feature = "url"))]
+/// Get the canonical "hello world" gitoid URL, parsed only once.
+///
+/// The round-trip tests all start from this same URL, so share one
+/// parsed copy rather than re-parsing it per test.
+fn hello_world_url() -> &'static Url {
+    static URL: OnceLock<Url> = OnceLock::new();
+    URL.get_or_init(|| {
+        Url::parse(
+            "gitoid:blob:sha256:fee53a18d32820613c0527aa79be5cb30173c823a9b448fa4817767cc84c6f03",
+        )
+        .unwrap()
+    })
+}
+
 #[cfg(all(feature = "sha1", feature = "rustcrypto", feature = "hex"))]
 #[test]
 fn generate_sha1_gitoid_from_bytes() {
@@ -53,8 +80,7 @@ fn generate_sha1_gitoid_from_buffer() -> Result<()> {
 #[cfg(all(feature = "sha256", feature = "rustcrypto"))]
 #[test]
 fn generate_sha256_gitoid_from_bytes() {
-    let input = b"hello world";
-    let result = GitOid::<Sha256, Blob>::id_bytes(input);
+    let result = hello_world_sha256();
 
     assert_eq!(
         result.as_hex(),
@@ -111,11 +137,12 @@ fn generate_sha256_gitoid_from_async_buffer() -> Result<()> {
 #[cfg(all(feature = "sha256", feature = "rustcrypto"))]
 #[test]
 fn validate_uri() -> Result<()> {
-    let content = b"hello world";
-    let gitoid = GitOid::<Sha256, Blob>::id_bytes(content);
+    let gitoid = hello_world_sha256();
 
+    // Compare borrowed string slices rather than allocating a fresh
+    // String out of the already-serialized URL.
     assert_eq!(
-        gitoid.url().to_string(),
+        gitoid.url().as_str(),
         "gitoid:blob:sha256:fee53a18d32820613c0527aa79be5cb30173c823a9b448fa4817767cc84c6f03"
     );
 
@@ -196,14 +223,33 @@ fn try_from_url_missing_hash() {
 
 #[cfg(all(feature = "sha256", feature = "rustcrypto", feature = "url"))]
 #[test]
-fn try_url_roundtrip() {
+fn try_from_url_bad_hex() {
     let url = Url::parse(
-        "gitoid:blob:sha256:fee53a18d32820613c0527aa79be5cb30173c823a9b448fa4817767cc84c6f03",
+        "gitoid:blob:sha256:zee53a18d32820613c0527aa79be5cb30173c823a9b448fa4817767cc84c6f03",
     )
     .unwrap();
+
+    match GitOid::<Sha256, Blob>::try_from_url(url) {
+        Ok(_) => panic!("gitoid parsing should fail"),
+        Err(e) => assert_eq!(e.to_string(), "invalid hex string"),
+    }
+}
+
+#[cfg(all(feature = "sha256", feature = "rustcrypto", feature = "url"))]
+#[test]
+fn try_url_roundtrip() {
+    let url = hello_world_url();
     let gitoid = GitOid::<Sha256, Blob>::try_from_url(url.clone()).unwrap();
     let output = gitoid.url();
-    assert_eq!(url, output);
+    assert_eq!(url, &output);
+}
+
+#[cfg(all(feature = "sha256", feature = "rustcrypto", feature = "url"))]
+#[test]
+fn from_str_roundtrip() {
+    let input = hello_world_url().as_str();
+    let gitoid: GitOid<Sha256, Blob> = input.parse().unwrap();
+    assert_eq!(gitoid.url().as_str(), input);
 }
 
 #[cfg(all(feature = "serde", feature = "sha256", feature = "rustcrypto"))]
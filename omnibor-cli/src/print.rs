@@ -7,17 +7,18 @@ use serde_json::json;
 use serde_json::Value as JsonValue;
 use std::fmt::Formatter;
 use std::fmt::Result as FmtResult;
-use std::future::Future;
 use std::panic;
 use std::path::Path;
-use std::result::Result as StdResult;
 use std::{fmt::Display, io::Write};
 use tokio::io::stderr;
 use tokio::io::stdout;
 use tokio::io::AsyncWriteExt as _;
+use tokio::io::BufWriter;
+use tokio::io::Stderr;
+use tokio::io::Stdout;
 use tokio::sync::mpsc;
 use tokio::sync::mpsc::Sender;
-use tokio::task::JoinError;
+use tokio::task::JoinHandle;
 use tracing::debug;
 use url::Url;
 
@@ -26,8 +27,11 @@ pub struct Printer {
     /// The transmitter to send message to the task.
     tx: Sender<PrinterCmd>,
 
-    /// The actual future to be awaited.
-    task: Box<dyn Future<Output = StdResult<(), JoinError>> + Unpin>,
+    /// The handle for the print queue task.
+    ///
+    /// Held as the concrete `JoinHandle` type; there is no reason to pay
+    /// for dynamic dispatch to await a single known future.
+    task: JoinHandle<()>,
 }
 
 impl Printer {
@@ -36,6 +40,13 @@ impl Printer {
         let (tx, mut rx) = mpsc::channel::<PrinterCmd>(buffer_size);
 
         let printer = tokio::spawn(async move {
+            // Open the output streams once for the lifetime of the task,
+            // rather than taking fresh handles for every message. Buffer
+            // stdout so many small messages batch into few writes; errors
+            // go to stderr unbuffered so they appear immediately.
+            let mut stdout = BufWriter::new(stdout());
+            let mut stderr = stderr();
+
             while let Some(msg) = rx.recv().await {
                 debug!(?msg);
 
@@ -43,30 +54,29 @@ impl Printer {
                     // Closing the stream ensures it still drains if there are messages in flight.
                     PrinterCmd::End => rx.close(),
                     PrinterCmd::Message(msg) => {
-                        let format = msg.format();
-                        let msg_clone = msg.clone();
-
-                        if let Err(err) = msg.print().await {
+                        if let Err(err) = msg.print(&mut stdout, &mut stderr).await {
                             // Fallback to only sync printing if the async printing failed.
-                            let err_msg = Msg::error(err, format);
+                            let err_msg = Msg::error(err, msg.format());
 
                             if let Err(err) = err_msg.sync_print() {
                                 panic!("failed to print sync error message: '{}'", err);
                             }
 
-                            if let Err(err) = msg_clone.sync_print() {
+                            if let Err(err) = msg.sync_print() {
                                 panic!("failed to print sync message: '{}'", err);
                             }
                         }
                     }
                 }
             }
+
+            // Flush the buffered output once, after the channel has drained.
+            if let Err(err) = stdout.flush().await {
+                panic!("failed to flush stdout: '{}'", err);
+            }
         });
 
-        Printer {
-            tx,
-            task: Box::new(printer),
-        }
+        Printer { tx, task: printer }
     }
 
     /// Send a message to the print task.
@@ -149,7 +159,7 @@ impl Msg {
 
         match format {
             Format::Plain => Msg::plain(status, &format!("{} => {}", path, url)),
-            Format::Short => Msg::plain(status, &url.to_string()),
+            Format::Short => Msg::plain(status, &url),
             Format::Json => Msg::json(status, json!({ "path": path, "id": url })),
         }
     }
@@ -162,7 +172,7 @@ impl Msg {
 
         match format {
             Format::Plain => Msg::plain(status, &format!("{} => {}", url, path)),
-            Format::Short => Msg::plain(status, &path.to_string()),
+            Format::Short => Msg::plain(status, &path),
             Format::Json => Msg::json(status, json!({ "path": path, "id": url })),
         }
     }
@@ -176,7 +186,7 @@ impl Msg {
 
         match format {
             Format::Plain => Msg::plain(status, &format!("root_dir: {}", dir)),
-            Format::Short => Msg::plain(status, &dir.to_string()),
+            Format::Short => Msg::plain(status, &dir),
             Format::Json => Msg::json(status, json!({ "root_dir": dir })),
         }
     }
@@ -220,14 +230,20 @@ impl Msg {
     }
 
     /// Print the Msg to the appropriate sink.
-    async fn print(self) -> Result<()> {
+    async fn print(&self, stdout: &mut BufWriter<Stdout>, stderr: &mut Stderr) -> Result<()> {
         let to_output = self.content.to_string();
-        self.write(to_output.as_bytes()).await?;
+        let bytes = to_output.as_bytes();
+
+        match self.status {
+            Status::Success => stdout.write_all(bytes).await?,
+            Status::Error => stderr.write_all(bytes).await?,
+        }
+
         Ok(())
     }
 
     /// Print the contents of the message synchronously.
-    fn sync_print(self) -> Result<()> {
+    fn sync_print(&self) -> Result<()> {
         let to_output = self.content.to_string();
         let bytes = to_output.as_bytes();
 
@@ -238,16 +254,6 @@ impl Msg {
 
         Ok(())
     }
-
-    /// Write bytes to the correct sink.
-    async fn write(&self, bytes: &[u8]) -> Result<()> {
-        match self.status {
-            Status::Success => stdout().write_all(bytes).await?,
-            Status::Error => stderr().write_all(bytes).await?,
-        }
-
-        Ok(())
-    }
 }
 
 /// The actual content of a message.
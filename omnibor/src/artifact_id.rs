@@ -337,7 +337,7 @@ impl<H: SupportedHash> ArtifactId<H> {
     /// What that means for us is that the `:` separator character is
     /// replaced with `_`.
     pub fn safe_name(&self) -> PathBuf {
-        self.gitoid.url().to_string().replace(':', "_").into()
+        self.gitoid.url().as_str().replace(':', "_").into()
     }
 
     /// Get the underlying bytes of the [`ArtifactId`] hash.
@@ -2,6 +2,7 @@
 
 use crate::ffi::error::catch_panic;
 use crate::ffi::error::get_error_msg;
+use crate::ffi::error::take_error_msg_cstr;
 use crate::ffi::error::Error;
 use crate::ffi::status::Status;
 use crate::ffi::util::check_null;
@@ -15,6 +16,7 @@ use core::ptr::null;
 use core::ptr::null_mut;
 use core::slice::from_raw_parts;
 use core::slice::from_raw_parts_mut;
+use core::str::from_utf8;
 use std::ffi::CString;
 use std::fs::File;
 #[cfg(target_family = "unix")]
@@ -48,6 +50,40 @@ pub unsafe extern "C" fn ob_error_message(buffer: *mut c_char, length: c_int) ->
     write_to_c_buf(&last_err, buffer)
 }
 
+/// Get a borrowed pointer to the last-written error message.
+///
+/// Unlike `ob_error_message`, this does not copy the message into a
+/// caller-provided buffer. If `len_out` is not null, the length of the
+/// message in bytes, not counting the NUL terminator, is written through it.
+///
+/// Returns null if no error message has been recorded, in which case
+/// `len_out` is set to zero if provided.
+///
+/// # Safety
+///
+/// The returned pointer borrows thread-local storage owned by the library.
+/// It must not be freed, and it is only valid until the next call to this
+/// function on the same thread.
+#[no_mangle]
+pub unsafe extern "C" fn ob_error_message_ptr(len_out: *mut usize) -> *const c_char {
+    match take_error_msg_cstr() {
+        Some((msg, len)) => {
+            if !len_out.is_null() {
+                unsafe { *len_out = len };
+            }
+
+            msg
+        }
+        None => {
+            if !len_out.is_null() {
+                unsafe { *len_out = 0 };
+            }
+
+            null()
+        }
+    }
+}
+
 /// Embed a C string into the binary.
 macro_rules! embed_cstr {
     ($name:ident, $arr:expr) => {
@@ -87,14 +123,12 @@ pub struct ArtifactIdSha256(ArtifactId<Sha256>);
 ///
 /// # Safety
 ///
-/// `content_len` is the number of elements, not the number of bytes.
-///
-/// `content_len` times 8 (byte size) must be less than or equal to the
-/// maximum size representable with an unsigned integer at the size used by
-/// the ISA (32-bit or 64-bit usually).
+/// `content_len` is the length of the buffer in bytes. Passing the size of
+/// some other local, like a length field, hashes the wrong memory; for an
+/// array, pass `sizeof` the array itself.
 ///
-/// `content` must not be null, and the length of the buffer must match the
-/// length in bytes passed by `content_len`.
+/// `content` must not be null, and must point to a single contiguous
+/// allocation of at least `content_len` bytes.
 #[no_mangle]
 pub unsafe extern "C" fn ob_aid_sha256_id_bytes(
     content: *mut u8,
@@ -111,6 +145,60 @@ pub unsafe extern "C" fn ob_aid_sha256_id_bytes(
     output.unwrap_or_else(null)
 }
 
+/// Construct `ArtifactId`s for a batch of buffers of bytes.
+///
+/// This is equivalent to calling `ob_aid_sha256_id_bytes` once per buffer,
+/// but crosses the FFI boundary a single time for the whole batch, which
+/// matters when identifying many small artifacts.
+///
+/// Writes one `ArtifactId` pointer into `ids` per input buffer and returns
+/// `0`, or a negative status code if any input is invalid. On error, the
+/// entries produced before the failure remain valid and must still be
+/// freed; all remaining entries are null.
+///
+/// # Safety
+///
+/// `contents`, `content_lens`, and `ids` must all point to arrays of at
+/// least `count` elements. Each buffer in `contents` must not be null, and
+/// its length in bytes must match the corresponding entry in
+/// `content_lens`.
+///
+/// Each `ArtifactId` produced must be freed with `ob_aid_sha256_free`.
+#[no_mangle]
+pub unsafe extern "C" fn ob_aid_sha256_id_bytes_batch(
+    contents: *const *mut u8,
+    content_lens: *const usize,
+    count: usize,
+    ids: *mut *const ArtifactIdSha256,
+) -> c_int {
+    if ids.is_null() {
+        return Status::BufferIsNull as c_int;
+    }
+
+    unsafe { from_raw_parts_mut(ids, count) }.fill(null());
+
+    let output = catch_panic(move || {
+        check_null(contents, Error::ContentPtrIsNull)?;
+        check_null(content_lens, Error::ContentPtrIsNull)?;
+
+        let contents = unsafe { from_raw_parts(contents, count) };
+        let content_lens = unsafe { from_raw_parts(content_lens, count) };
+        let ids = unsafe { from_raw_parts_mut(ids, count) };
+
+        for ((content, content_len), id) in contents.iter().zip(content_lens).zip(ids.iter_mut()) {
+            check_null(*content, Error::ContentPtrIsNull)?;
+            let content = unsafe { from_raw_parts(*content, *content_len) };
+            let artifact_id = ArtifactIdSha256(ArtifactId::<Sha256>::id_bytes(content));
+            let boxed = Box::new(artifact_id);
+            *id = Box::into_raw(boxed) as *const _;
+        }
+
+        Ok(0)
+    });
+
+    output.unwrap_or(Status::InvalidPtr as c_int)
+}
+
 /// Construct a new `ArtifactId` from a C-string of data.
 ///
 /// # Safety
@@ -152,6 +240,36 @@ pub unsafe extern "C" fn ob_aid_sha256_try_from_url(s: *const c_char) -> *const
     output.unwrap_or_else(null)
 }
 
+/// Construct a new `ArtifactId` from a `URL` in a string with a known length.
+///
+/// This is equivalent to `ob_aid_sha256_try_from_url` for callers which
+/// already know the string's length in bytes, and skips the linear scan
+/// for a nul-terminator that `ob_aid_sha256_try_from_url` performs.
+///
+/// # Safety
+///
+/// The pointer must not be null, and must point to a valid UTF-8 string of
+/// at least `length` bytes, all in a single contiguous allocation. No
+/// nul-terminator is required.
+///
+/// The returned `ArtifactId` must be freed.
+#[no_mangle]
+pub unsafe extern "C" fn ob_aid_sha256_try_from_url_len(
+    s: *const c_char,
+    length: usize,
+) -> *const ArtifactIdSha256 {
+    let output = catch_panic(|| {
+        check_null(s, Error::StringPtrIsNull)?;
+        let raw_url = from_utf8(unsafe { from_raw_parts(s as *const u8, length) })?;
+        let url = Url::parse(raw_url)?;
+        let artifact_id = ArtifactIdSha256(ArtifactId::<Sha256>::try_from_url(url)?);
+        let boxed = Box::new(artifact_id);
+        Ok(Box::into_raw(boxed) as *const _)
+    });
+
+    output.unwrap_or_else(null)
+}
+
 /// Create a new `ArtifactId` by reading data from a file.
 ///
 /// # Safety
@@ -267,6 +385,41 @@ pub unsafe extern "C" fn ob_aid_sha256_url(ptr: *const ArtifactIdSha256) -> *con
     output.unwrap_or_else(null)
 }
 
+/// Write the URL representation of a `ArtifactId` into a buffer.
+///
+/// This is an allocation-free alternative to `ob_aid_sha256_url`: the URL
+/// is written into the caller-provided buffer, including a nul-terminator,
+/// with nothing to free afterward.
+///
+/// Returns `0` if successful, and a negative status code otherwise.
+///
+/// # Safety
+///
+/// The length passed must match the length of the buffer provided.
+///
+/// If either pointer is null, the function will fail and return an error
+/// code.
+#[no_mangle]
+pub unsafe extern "C" fn ob_aid_sha256_url_buf(
+    ptr: *const ArtifactIdSha256,
+    buffer: *mut c_char,
+    length: c_int,
+) -> c_int {
+    if buffer.is_null() {
+        return Status::BufferIsNull as c_int;
+    }
+
+    let output = catch_panic(|| {
+        check_null(ptr, Error::ArtifactIdPtrIsNull)?;
+        let artifact_id = unsafe { &*ptr };
+        let url = artifact_id.0.url();
+        let buffer = unsafe { from_raw_parts_mut(buffer as *mut u8, length as usize) };
+        Ok(write_to_c_buf(url.as_str(), buffer))
+    });
+
+    output.unwrap_or(Status::InvalidPtr as c_int)
+}
+
 /// Get the name of an `ObjectType` as a C-string.
 ///
 /// # Safety
@@ -15,12 +15,14 @@
 use crate::error::Error as ArtifactIdError;
 use core::any::Any;
 use core::cell::RefCell;
+use core::ffi::c_char;
 use core::fmt::Display;
 use core::fmt::Formatter;
 use core::fmt::Result as FmtResult;
 use core::panic::UnwindSafe;
 use core::str::Utf8Error;
 use std::error::Error as StdError;
+use std::ffi::CString;
 use std::ffi::NulError;
 use std::panic::catch_unwind;
 use url::ParseError as UrlError;
@@ -30,6 +32,12 @@ thread_local! {
     /// cbindgen:ignore
     #[doc(hidden)]
     static LAST_ERROR: RefCell<Option<String>> = const { RefCell::new(None) };
+
+    // Owns the NUL-terminated copy of the last error message handed out by
+    // `ob_error_message_ptr`, keeping the borrowed pointer valid.
+    /// cbindgen:ignore
+    #[doc(hidden)]
+    static LAST_ERROR_CSTR: RefCell<CString> = RefCell::new(CString::default());
 }
 
 /// Update the last error with a new error message.
@@ -46,6 +54,27 @@ pub(crate) fn get_error_msg() -> Option<String> {
     LAST_ERROR.with(|last| last.borrow_mut().take())
 }
 
+/// Take the last error message into thread-local C string storage.
+///
+/// Returns a borrowed pointer to the stored message along with its length in
+/// bytes, not counting the NUL terminator, or `None` if no error message has
+/// been recorded. The pointer remains valid until the next call to this
+/// function on the same thread.
+pub(crate) fn take_error_msg_cstr() -> Option<(*const c_char, usize)> {
+    let msg = get_error_msg()?;
+    // PANIC SAFETY: Error messages are built from `Display` impls and never
+    //               contain interior NUL bytes.
+    let msg = CString::new(msg).unwrap();
+
+    LAST_ERROR_CSTR.with(|last| {
+        let mut last = last.borrow_mut();
+        *last = msg;
+        // The pointer is to the `CString`'s heap buffer, which stays put when
+        // the `CString` itself is moved into the cell.
+        Some((last.as_ptr(), last.as_bytes().len()))
+    })
+}
+
 /// Convenient panic-catching and reporting.
 ///
 /// This wraps `std::panic::catch_unwind`, but enables you to write functions
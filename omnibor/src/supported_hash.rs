@@ -9,6 +9,11 @@ pub trait SupportedHash: Sealed {
 }
 
 /// The SHA-256 hashing algorithm.
+///
+/// Hashing dispatches to the CPU's SHA extensions when they are present,
+/// detected at runtime by the underlying cryptography crates, so
+/// [`ArtifactId`] construction gets hardware-speed hashing without any
+/// build-time configuration.
 pub struct Sha256 {
     #[doc(hidden)]
     _private: (),